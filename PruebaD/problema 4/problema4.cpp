@@ -2,8 +2,17 @@
 #include <fstream>
 #include <string>
 #include <unordered_map>
-#include <cctype>
 #include <sstream>
+#include <vector>
+#include <algorithm>
+#include <stdexcept>
+#include <random>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
 
 // Traductor simple de palabras reservadas de C a español.
 // Lee código C desde memoria (string) o desde un fichero y reemplaza
@@ -23,9 +32,98 @@ static const std::unordered_map<std::string, std::string> translations = {
     {"_Imaginary","imaginario"}
 };
 
-// Detecta un identificador (letra o '_' seguido de letras/dígitos/_)
-static inline bool isIdentStart(char c) { return std::isalpha(static_cast<unsigned char>(c)) || c == '_'; }
-static inline bool isIdentBody(char c) { return std::isalnum(static_cast<unsigned char>(c)) || c == '_'; }
+// Detecta un identificador (letra o '_' seguido de letras/dígitos/_).
+// Clasificación ASCII, sin depender de la configuración regional, igual que
+// la del escáner vectorizado.
+static inline bool asciiLetter(char c) { return (c | 0x20) >= 'a' && (c | 0x20) <= 'z'; }
+static inline bool asciiDigit(char c) { return c >= '0' && c <= '9'; }
+static inline bool isIdentStart(char c) { return asciiLetter(c) || c == '_'; }
+static inline bool isIdentBody(char c) { return asciiLetter(c) || asciiDigit(c) || c == '_'; }
+
+// Estado del analizador entre dos unidades léxicas. Junto con la posición en
+// la fuente basta para reanudar el análisis en cualquier punto.
+enum class LexMode { Code, String, LineComment, BlockComment };
+
+struct LexState {
+    LexMode mode = LexMode::Code;
+    char quote = 0; // comilla que abrió el literal (solo en LexMode::String)
+
+    bool operator==(const LexState &o) const { return mode == o.mode && quote == o.quote; }
+};
+
+// Procesa una unidad léxica que empieza en src[i], la escribe en out y
+// devuelve la posición siguiente. Una unidad es indivisible: un identificador
+// completo, un escape "\x", un "//", "/*" o "*/", o un único carácter.
+// Una unidad que termina en p no depende de bytes posteriores a src[p].
+// Avanzar carácter a carácter dentro de literales y comentarios permite a
+// IncrementalTranslator poner puntos de control en cualquier sitio;
+// translateKeywords, en cambio, copia esos tramos en bucles propios.
+static size_t lexStep(const std::string &src, size_t i, LexState &st, std::string &out) {
+    size_t n = src.size();
+    char c = src[i];
+    switch (st.mode) {
+    case LexMode::String:
+        out.push_back(c);
+        if (c == '\\') { // escape: copia también el siguiente carácter si existe
+            if (i + 1 < n) { out.push_back(src[i+1]); return i + 2; }
+        } else if (c == st.quote) {
+            st = LexState{};
+        }
+        return i + 1;
+
+    case LexMode::LineComment:
+        out.push_back(c);
+        if (c == '\n') st = LexState{};
+        return i + 1;
+
+    case LexMode::BlockComment:
+        if (c == '*' && i + 1 < n && src[i+1] == '/') {
+            out.append("*/");
+            st = LexState{};
+            return i + 2;
+        }
+        out.push_back(c);
+        return i + 1;
+
+    case LexMode::Code:
+        break;
+    }
+
+    // Strings
+    if (c == '"' || c == '\'') {
+        out.push_back(c);
+        st.mode = LexMode::String;
+        st.quote = c;
+        return i + 1;
+    }
+
+    // Comments
+    if (c == '/' && i + 1 < n) {
+        char d = src[i+1];
+        if (d == '/' || d == '*') {
+            out.append(src, i, 2);
+            st.mode = (d == '/') ? LexMode::LineComment : LexMode::BlockComment;
+            return i + 2;
+        }
+    }
+
+    // Identifier
+    if (isIdentStart(c)) {
+        size_t j = i + 1;
+        while (j < n && isIdentBody(src[j])) ++j;
+        auto it = translations.find(src.substr(i, j - i));
+        if (it != translations.end()) {
+            out += it->second; // reemplaza por traducción
+        } else {
+            out.append(src, i, j - i); // copia tal cual
+        }
+        return j;
+    }
+
+    // cualquier otro caracter
+    out.push_back(c);
+    return i + 1;
+}
 
 std::string translateKeywords(const std::string &src) {
     std::string out;
@@ -96,8 +194,484 @@ std::string translateKeywords(const std::string &src) {
     return out;
 }
 
+// ---------------------------------------------------------------------------
+// Versión vectorizada. Cada bloque de 64 bytes se clasifica una sola vez con
+// SIMD en máscaras de bits (comillas, '\\', '/', '*', '\n', bytes de
+// identificador e inicios de racha de identificador); después los siguientes
+// bytes relevantes se localizan con ctz sobre esas máscaras y los tramos
+// intermedios se copian de una vez. lexStep solo interviene en los cambios de
+// estado (comillas, escapes, "//", "/*", "*/"), así que la salida es idéntica
+// a la de translateKeywords, que sirve de respaldo y de referencia.
+// Se usa SSE2 (presente en todo x86-64): cuatro comparaciones de 16 bytes
+// cuyas máscaras (movemask) se combinan en 64 bits.
+
+// Máscaras de un bloque: bit k a 1 si el byte k del bloque es de la clase.
+struct BlockMasks {
+    uint64_t dquote = 0, squote = 0, slash = 0, star = 0, backslash = 0, newline = 0;
+    uint64_t body = 0;     // letra, dígito o '_'
+    uint64_t start = 0;    // letra o '_'
+    uint64_t runStart = 0; // primer byte de cada racha de bytes de identificador
+};
+
+#if defined(__SSE2__)
+static inline __m128i simdRange(__m128i v, char lo, char hi) {
+    return _mm_and_si128(_mm_cmpgt_epi8(v, _mm_set1_epi8(static_cast<char>(lo - 1))),
+                         _mm_cmplt_epi8(v, _mm_set1_epi8(static_cast<char>(hi + 1))));
+}
+static inline __m128i simdEq(__m128i v, char c) { return _mm_cmpeq_epi8(v, _mm_set1_epi8(c)); }
+static inline __m128i simdLetter(__m128i v) { return simdRange(_mm_or_si128(v, _mm_set1_epi8(0x20)), 'a', 'z'); }
+#endif
+
+// Clasifica los 64 bytes de p. carry indica si el byte anterior al bloque es
+// de identificador, para que las rachas no se corten en el borde.
+static inline BlockMasks classifyBlock(const char *p, bool carry) {
+    BlockMasks m;
+#if defined(__SSE2__)
+    for (int k = 0; k < 4; ++k) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p + 16 * k));
+        auto bits = [k](__m128i x) {
+            return static_cast<uint64_t>(static_cast<unsigned>(_mm_movemask_epi8(x))) << (16 * k);
+        };
+        __m128i start = _mm_or_si128(simdLetter(v), simdEq(v, '_'));
+        m.dquote    |= bits(simdEq(v, '"'));
+        m.squote    |= bits(simdEq(v, '\''));
+        m.slash     |= bits(simdEq(v, '/'));
+        m.star      |= bits(simdEq(v, '*'));
+        m.backslash |= bits(simdEq(v, '\\'));
+        m.newline   |= bits(simdEq(v, '\n'));
+        m.start     |= bits(start);
+        m.body      |= bits(_mm_or_si128(start, simdRange(v, '0', '9')));
+    }
+#else
+    for (int k = 0; k < 64; ++k) {
+        uint64_t b = uint64_t(1) << k;
+        char c = p[k];
+        if (c == '"') m.dquote |= b;
+        if (c == '\'') m.squote |= b;
+        if (c == '/') m.slash |= b;
+        if (c == '*') m.star |= b;
+        if (c == '\\') m.backslash |= b;
+        if (c == '\n') m.newline |= b;
+        if (isIdentStart(c)) m.start |= b;
+        if (isIdentBody(c)) m.body |= b;
+    }
+#endif
+    m.runStart = m.body & ~((m.body << 1) | (carry ? 1u : 0u));
+    return m;
+}
+
+static inline unsigned ctz64(uint64_t x) {
+#if defined(__GNUC__)
+    return static_cast<unsigned>(__builtin_ctzll(x));
+#else
+    unsigned k = 0;
+    while (!(x & 1)) { x >>= 1; ++k; }
+    return k;
+#endif
+}
+
+// Recorre la fuente hacia delante guardando las máscaras del bloque actual,
+// de modo que cada bloque se clasifica una única vez aunque se consulte
+// varias veces (fin de identificador, siguiente comilla, etc.).
+class BlockScanner {
+public:
+    explicit BlockScanner(const std::string &src) : s(src.data()), n(src.size()) {}
+
+    // Primera posición >= pos cuyo bit está a 1 en select(máscaras), o n.
+    template <class Select>
+    size_t next(size_t pos, Select select) {
+        while (pos < n) {
+            size_t b = pos & ~static_cast<size_t>(63);
+            if (b != base) load(b);
+            uint64_t bits = select(masks) & (~uint64_t(0) << (pos - b));
+            if (bits) return std::min(n, b + ctz64(bits));
+            pos = b + 64;
+        }
+        return n;
+    }
+
+private:
+    void load(size_t b) {
+        bool carry = b > 0 && isIdentBody(s[b - 1]);
+        if (b + 64 <= n) {
+            masks = classifyBlock(s + b, carry);
+        } else {
+            char tail[64] = {}; // el relleno con '\0' no pertenece a ninguna clase
+            std::memcpy(tail, s + b, n - b);
+            masks = classifyBlock(tail, carry);
+        }
+        base = b;
+    }
+
+    const char *s;
+    size_t n;
+    size_t base = static_cast<size_t>(-1);
+    BlockMasks masks;
+};
+
+std::string translateKeywordsSimd(const std::string &src) {
+    // Palabras reservadas agrupadas por (primer byte, longitud): cada
+    // identificador se compara con memcmp contra su grupo, casi siempre vacío
+    // o de un elemento, sin construir cadenas ni calcular hashes.
+    const size_t maxLen = 16;
+    using Entry = std::pair<const std::string, std::string>;
+    static const std::vector<std::vector<const Entry *>> keywords = [&] {
+        std::vector<std::vector<const Entry *>> t(256 * maxLen);
+        for (const auto &kv : translations)
+            t[static_cast<unsigned char>(kv.first[0]) * maxLen + kv.first.size()].push_back(&kv);
+        return t;
+    }();
+
+    auto codeEvents = [](const BlockMasks &m) { return m.dquote | m.squote | m.slash | m.runStart; };
+    auto identEnd = [](const BlockMasks &m) { return ~m.body; };
+    auto skipDigits = [](const BlockMasks &m) { return m.start | ~m.body; };
+
+    std::string out;
+    out.reserve(src.size());
+
+    // Solo las palabras reservadas cambian bytes: literales, comentarios,
+    // identificadores normales y cambios de estado se copian tal cual. Se
+    // acumulan en un tramo pendiente [copyFrom, i) que se vuelca con un único
+    // append cuando aparece una traducción o al terminar.
+    const char *s = src.data();
+    size_t copyFrom = 0;
+    std::string unit; // salida descartada de lexStep: coincide con la entrada
+
+    BlockScanner scan(src);
+    LexState st;
+    size_t i = 0, n = src.size();
+    while (i < n) {
+        switch (st.mode) {
+        case LexMode::Code:
+            i = scan.next(i, codeEvents);
+            break;
+        case LexMode::String: {
+            bool dq = st.quote == '"';
+            i = scan.next(i, [dq](const BlockMasks &m) { return (dq ? m.dquote : m.squote) | m.backslash; });
+            break;
+        }
+        case LexMode::LineComment:
+            i = scan.next(i, [](const BlockMasks &m) { return m.newline; });
+            break;
+        case LexMode::BlockComment:
+            i = scan.next(i, [](const BlockMasks &m) { return m.star; });
+            break;
+        }
+        if (i >= n) break;
+
+        if (st.mode == LexMode::Code && isIdentBody(s[i])) {
+            // Racha de bytes de identificador. Los dígitos iniciales no forman
+            // parte del identificador, igual que en translateKeywords ("1int"
+            // es '1' seguido de "int").
+            if (!isIdentStart(s[i])) {
+                i = scan.next(i, skipDigits);
+                if (i >= n || !isIdentStart(s[i])) continue;
+            }
+            size_t j = scan.next(i + 1, identEnd);
+            size_t len = j - i;
+            if (len < maxLen) {
+                for (const Entry *kw : keywords[static_cast<unsigned char>(s[i]) * maxLen + len]) {
+                    if (std::memcmp(kw->first.data(), s + i, len) == 0) {
+                        out.append(s + copyFrom, i - copyFrom);
+                        out += kw->second; // reemplaza por traducción
+                        copyFrom = j;
+                        break;
+                    }
+                }
+            }
+            i = j;
+            continue;
+        }
+
+        unit.clear();
+        i = lexStep(src, i, st, unit); // cambio de estado
+    }
+    out.append(s + copyFrom, n - copyFrom);
+
+    return out;
+}
+
+// Traducción incremental para vistas previas en vivo (p. ej. un editor).
+// Guarda cada `checkpointInterval` bytes un punto de control con el estado del
+// analizador y la correspondencia posición fuente -> posición salida.
+// Tras una edición se vuelve a analizar desde el último punto de control
+// anterior a la edición y solo hasta que el estado coincide de nuevo con
+// un punto de control antiguo; el resto de la salida se reutiliza.
+// Limitación: el re-análisis está acotado, pero fuente y salida son
+// std::string contiguos, así que cada edición sigue desplazando la cola de
+// ambos (y los puntos de control posteriores): coste O(tamaño del fichero)
+// en copias, mucho menor que re-traducir, pero no proporcional a la edición.
+class IncrementalTranslator {
+public:
+    explicit IncrementalTranslator(const std::string &source = "", size_t checkpointInterval = 4096)
+        : interval(checkpointInterval > 0 ? checkpointInterval : 1) {
+        checkpoints.push_back(Checkpoint{});
+        edit(0, 0, source);
+    }
+
+    const std::string &source() const { return src; }
+    const std::string &output() const { return out; }
+
+    // Sustituye src[pos, pos+oldLen) por text y actualiza la salida.
+    void edit(size_t pos, size_t oldLen, const std::string &text) {
+        if (pos > src.size()) throw std::out_of_range("IncrementalTranslator::edit");
+        oldLen = std::min(oldLen, src.size() - pos);
+        size_t oldEnd = pos + oldLen;
+        size_t newEnd = pos + text.size();
+        src.replace(pos, oldLen, text);
+
+        // Punto de partida: último punto de control estrictamente anterior a
+        // la edición (la unidad que termina en él puede depender de src[pos]).
+        size_t c = firstAtOrAfter(pos);
+        if (c > 0) --c;
+        // Primer punto de control antiguo que puede servir para resincronizar
+        // (nunca el de partida, que debe conservarse).
+        size_t k = std::max(firstAtOrAfter(oldEnd), c + 1);
+
+        LexState st = checkpoints[c].state;
+        size_t i = checkpoints[c].src, last = i;
+        size_t outBase = checkpoints[c].out;
+        std::string buf;
+        std::vector<Checkpoint> fresh;
+        bool synced = false;
+
+        while (i < src.size()) {
+            if (i >= newEnd) {
+                // posición equivalente en la fuente antigua: i - newEnd + oldEnd
+                while (k < checkpoints.size() && checkpoints[k].src - oldEnd + newEnd < i) ++k;
+                if (k < checkpoints.size() && checkpoints[k].src - oldEnd + newEnd == i
+                    && checkpoints[k].state == st) {
+                    synced = true;
+                    break;
+                }
+            }
+            if (i - last >= interval) {
+                fresh.push_back(Checkpoint{i, outBase + buf.size(), st});
+                last = i;
+            }
+            i = lexStep(src, i, st, buf);
+        }
+
+        if (!synced) {
+            out.replace(outBase, std::string::npos, buf);
+            checkpoints.resize(c + 1);
+            checkpoints.insert(checkpoints.end(), fresh.begin(), fresh.end());
+            return;
+        }
+
+        // A partir del punto k la salida antigua sigue siendo válida: se
+        // parchea el tramo re-analizado y se desplazan los puntos siguientes.
+        size_t oldOutEnd = checkpoints[k].out;
+        size_t newOutEnd = outBase + buf.size();
+        out.replace(outBase, oldOutEnd - outBase, buf);
+        for (size_t j = k; j < checkpoints.size(); ++j) {
+            checkpoints[j].src = checkpoints[j].src - oldEnd + newEnd;
+            checkpoints[j].out = checkpoints[j].out - oldOutEnd + newOutEnd;
+        }
+        checkpoints.erase(checkpoints.begin() + c + 1, checkpoints.begin() + k);
+        checkpoints.insert(checkpoints.begin() + c + 1, fresh.begin(), fresh.end());
+    }
+
+    // Posición en la salida donde empieza la traducción de la unidad léxica
+    // que contiene src[srcPos].
+    size_t outputOffset(size_t srcPos) const {
+        if (srcPos >= src.size()) return out.size();
+        size_t c = firstAtOrAfter(srcPos + 1) - 1;
+        LexState st = checkpoints[c].state;
+        size_t i = checkpoints[c].src;
+        std::string scratch;
+        while (true) {
+            size_t before = scratch.size();
+            size_t next = lexStep(src, i, st, scratch);
+            if (next > srcPos) return checkpoints[c].out + before;
+            i = next;
+        }
+    }
+
+private:
+    struct Checkpoint {
+        size_t src = 0; // posición en la fuente
+        size_t out = 0; // posición correspondiente en la salida
+        LexState state; // estado del analizador en esa posición
+    };
+
+    // Índice del primer punto de control con src >= pos.
+    size_t firstAtOrAfter(size_t pos) const {
+        auto it = std::lower_bound(checkpoints.begin(), checkpoints.end(), pos,
+            [](const Checkpoint &cp, size_t p) { return cp.src < p; });
+        return static_cast<size_t>(it - checkpoints.begin());
+    }
+
+    std::string src, out;
+    std::vector<Checkpoint> checkpoints; // ordenados por src; el primero está en 0
+    size_t interval;
+};
+
+// Fragmentos con los que se generan fuentes y ediciones aleatorias para las
+// pruebas: abundan los que cambian el estado léxico.
+static const char *const selfTestPieces[] = {
+    "/*", "*/", "*", "/", "//", "\"", "'", "\\", "\n", " ", "int", "for", "if", "x", "_a1", "9", "\xC3\xA9"
+};
+
+static std::string randomSnippet(std::mt19937 &rng, size_t pieces) {
+    const size_t count = sizeof(selfTestPieces) / sizeof(selfTestPieces[0]);
+    std::string s;
+    for (size_t k = 0; k < pieces; ++k) s += selfTestPieces[rng() % count];
+    return s;
+}
+
+// Comprueba outputOffset recorriendo la fuente unidad a unidad con lexStep.
+static bool checkOffsets(const IncrementalTranslator &t) {
+    const std::string &src = t.source();
+    std::string out;
+    LexState st;
+    size_t i = 0;
+    while (i < src.size()) {
+        size_t start = out.size();
+        size_t next = lexStep(src, i, st, out);
+        for (size_t p = i; p < next; ++p)
+            if (t.outputOffset(p) != start) return false;
+        i = next;
+    }
+    return t.outputOffset(src.size()) == t.output().size();
+}
+
+// Prueba diferencial: IncrementalTranslator frente a translateKeywords tras
+// inserciones y borrados aleatorios, con intervalos de control pequeños para
+// que las ediciones caigan a menudo sobre los puntos de control o junto a ellos.
+static bool selfTestIncremental(std::mt19937 &rng) {
+    for (int run = 0; run < 400; ++run) {
+        size_t interval = 1 + rng() % 16;
+        IncrementalTranslator t(randomSnippet(rng, rng() % 120), interval);
+        for (int e = 0; e < 60; ++e) {
+            size_t n = t.source().size();
+            size_t pos = rng() % (n + 1);
+            if (rng() % 2) pos = std::min(n, pos / interval * interval + rng() % 2);
+            size_t len = (rng() % 3 == 0) ? 0 : rng() % 8;
+            std::string text = (rng() % 3 == 0) ? "" : randomSnippet(rng, 1 + rng() % 4);
+            t.edit(pos, len, text);
+            if (t.output() != translateKeywords(t.source())) {
+                std::cerr << "Incremental: salida distinta (intervalo " << interval
+                          << ", edición en " << pos << ")" << std::endl;
+                return false;
+            }
+        }
+        if (!checkOffsets(t)) {
+            std::cerr << "Incremental: outputOffset incorrecto" << std::endl;
+            return false;
+        }
+    }
+    return true;
+}
+
+// Prueba diferencial: translateKeywordsSimd frente a translateKeywords.
+// Además de fuentes aleatorias (incluidas de menos de 32 bytes y con bytes
+// >= 0x80) coloca '*', '\\', comillas y '/' en los bordes de los bloques de
+// 16 y 32 bytes, dentro de literales y comentarios sin cerrar y al final de
+// identificadores que cruzan un bloque.
+static bool selfTestSimd(std::mt19937 &rng) {
+    static const char *const prefixes[] = { "", "/*", "//", "\"", "'", "x" };
+    static const char *const specials[] = { "*", "*/", "\\", "\"", "'", "/", "/*", "\n", "if", "\xFF" };
+    static const size_t edges[] = { 15, 16, 17, 31, 32, 33, 47, 48, 63, 64, 65 };
+    const size_t nPrefixes = sizeof(prefixes) / sizeof(prefixes[0]);
+    const size_t nSpecials = sizeof(specials) / sizeof(specials[0]);
+    const size_t nEdges = sizeof(edges) / sizeof(edges[0]);
+
+    for (int run = 0; run < 60000; ++run) {
+        std::string s;
+        switch (run % 3) {
+        case 0: // fragmentos que cambian el estado léxico
+            s = randomSnippet(rng, rng() % 40);
+            break;
+        case 1: // bytes arbitrarios, cualquier longitud hasta 100
+            for (size_t k = rng() % 100; k > 0; --k) s.push_back(static_cast<char>(rng() & 0xFF));
+            break;
+        default: { // relleno homogéneo con un byte especial en un borde de bloque
+            const char fill[] = { 'a', ' ', '_', '9' };
+            s = prefixes[rng() % nPrefixes];
+            s.append(edges[rng() % nEdges] + rng() % 2 * 32 - s.size(), fill[rng() % 4]);
+            s += specials[rng() % nSpecials];
+            s.append(rng() % 40, fill[rng() % 4]);
+            break;
+        }
+        }
+        if (translateKeywordsSimd(s) != translateKeywords(s)) {
+            std::cerr << "SIMD: salida distinta para una entrada de " << s.size() << " bytes" << std::endl;
+            return false;
+        }
+    }
+    return true;
+}
+
+static int runSelfTest() {
+    std::mt19937 rng(12345);
+    bool incrementalOk = selfTestIncremental(rng);
+    std::cout << "Traducción incremental: " << (incrementalOk ? "OK" : "FALLO") << "\n";
+    bool simdOk = selfTestSimd(rng);
+    std::cout << "Escáner vectorizado: " << (simdOk ? "OK" : "FALLO") << "\n";
+    return (incrementalOk && simdOk) ? 0 : 4;
+}
+
+// Mide el rendimiento de ambas versiones sobre src y comprueba que la salida
+// vectorizada coincide con la escalar. La referencia es translateKeywords,
+// el bucle original byte a byte (no lexStep), para que la relación mida el
+// escáner y no una referencia más lenta.
+static int runBenchmark(const std::string &src) {
+    const int reps = 10;
+    auto measure = [&](std::string (*fn)(const std::string &), std::string &result) {
+        auto t0 = std::chrono::steady_clock::now();
+        for (int r = 0; r < reps; ++r) result = fn(src);
+        std::chrono::duration<double> dt = std::chrono::steady_clock::now() - t0;
+        return static_cast<double>(src.size()) * reps / dt.count() / 1e9;
+    };
+
+    std::string scalarOut, simdOut;
+    double scalarGBs = measure(translateKeywords, scalarOut);
+    double simdGBs = measure(translateKeywordsSimd, simdOut);
+
+    std::cout << "Entrada: " << src.size() << " bytes, " << reps << " repeticiones\n";
+    std::cout << "Escalar (bucle original): " << scalarGBs << " GB/s\n";
+    std::cout << "Vectorizado:              " << simdGBs << " GB/s (x" << simdGBs / scalarGBs << ")\n";
+    if (scalarOut != simdOut) {
+        std::cerr << "ERROR: la salida vectorizada no coincide con la escalar" << std::endl;
+        return 3;
+    }
+    std::cout << "Salidas idénticas\n";
+    return 0;
+}
+
 int main(int argc, char** argv) {
     std::string src;
+    if (argc >= 2 && std::string(argv[1]) == "--selftest") {
+        // problema4 --selftest: pruebas diferenciales contra el traductor escalar
+        return runSelfTest();
+    }
+    if (argc >= 2 && std::string(argv[1]) == "--bench") {
+        // problema4 --bench [fichero]: sin fichero se usa un código sintético de ~64 MB
+        if (argc >= 3) {
+            std::ifstream in(argv[2], std::ios::binary);
+            if (!in) {
+                std::cerr << "No se pudo abrir fichero: " << argv[2] << std::endl;
+                return 1;
+            }
+            std::ostringstream ss;
+            ss << in.rdbuf();
+            src = ss.str();
+        } else {
+            const std::string sample =
+                "/* Bloque de comentario: for, while e if no se traducen aqui. */\n"
+                "static int contar(const char *texto, unsigned long limite) {\n"
+                "    int total = 0; // for dentro de un comentario de linea\n"
+                "    for (unsigned long i = 0; i < limite && texto[i] != '\\0'; ++i) {\n"
+                "        if (texto[i] == '\"') printf(\"comilla \\\" y while: %d\\n\", total);\n"
+                "        else total += sizeof(long);\n"
+                "    }\n"
+                "    return total;\n"
+                "}\n\n";
+            while (src.size() < (64u << 20)) src += sample;
+        }
+        return runBenchmark(src);
+    }
     if (argc >= 2) {
         // leer fichero especificado
         std::ifstream in(argv[1], std::ios::binary);
@@ -115,7 +689,7 @@ int main(int argc, char** argv) {
         src = ss.str();
     }
 
-    std::string out = translateKeywords(src);
+    std::string out = translateKeywordsSimd(src);
 
     // Si se pasó un segundo argumento, escribir a fichero de salida
     if (argc >= 3) {